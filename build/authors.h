@@ -0,0 +1,15 @@
+R"AUTHORS(
+Copyright (C) 2017-2022 Fredrik Öhrström
+                   2022 thecem
+                   2022 Patrick Schwarz
+                   2022 Kajetan Krykwiński
+                   2021 Vincent Privat
+                   2021 Olli Salonen
+                   2020 Eric Bus
+                   2020 Avandorp
+                   2019 kokke
+                   2019 Jacek Tomasiak
+                   2018 David Mallon
+                   2013 WaterJuice
+                   2013 Tom St Denis
+)AUTHORS";